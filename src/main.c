@@ -20,6 +20,7 @@
 
 #include "enamel.h"
 #include "watch_model.h"
+#include "polar_lookup.h"
 #include <pebble-events/pebble-events.h>
 #include <ctype.h>
 #include <stdlib.h>
@@ -126,19 +127,19 @@ static void draw_date_seconds(Layer *layer, GContext *ctx) {
     int h = layer_bounds.size.h;
     GRect seconds_center_rect = (GRect) { .size = GSize(w*.48, h*.48) };
     grect_align(&seconds_center_rect, &layer_bounds, GAlignCenter, false);
-    GRect seconds_frame = grect_centered_from_polar(seconds_center_rect, GOvalScaleModeFitCircle,
-                                                    DEG_TO_TRIGANGLE(clock_state.minute_angle-55),
-                                                    GSize(w*.2, h*.2));
+    GRect seconds_frame = polar_lookup_centered_rect(PolarRingSubdialCenter, seconds_center_rect,
+                                                     clock_state.minute_angle-55,
+                                                     GSize(w*.2, h*.2));
     if (enamel_get_display_seconds() && !battery_saver_enabled(clock_state.hour)) {
         // second dial markers
 	draw_tick_marks(ctx, seconds_frame, w);
         // seconds hand
         // end point
-	GRect sec_to_rect = grect_centered_from_polar(seconds_center_rect, GOvalScaleModeFitCircle,
-                                                      DEG_TO_TRIGANGLE(clock_state.minute_angle-55),
-                                                      GSize(w*.19, h*.19));
-        GPoint sec_to = gpoint_from_polar(sec_to_rect, GOvalScaleModeFitCircle,
-                                          DEG_TO_TRIGANGLE(clock_state.second_angle));
+	GRect sec_to_rect = polar_lookup_centered_rect(PolarRingSubdialCenter, seconds_center_rect,
+                                                       clock_state.minute_angle-55,
+                                                       GSize(w*.19, h*.19));
+        GPoint sec_to = polar_lookup_point(PolarRingSecondsHandTo, sec_to_rect,
+                                           clock_state.second_angle);
         // draw seconds hand
         graphics_context_set_stroke_width(ctx, 3);
         graphics_context_set_stroke_color(ctx, enamel_get_clock_fg_color());
@@ -192,9 +193,9 @@ static void draw_day(Layer *layer, GContext *ctx) {
     int h = layer_bounds.size.h;
     GRect day_center_rect = (GRect) { .size = GSize(w*.48, h*.48) };
     grect_align(&day_center_rect, &layer_bounds, GAlignCenter, false);
-    GRect day_frame = grect_centered_from_polar(day_center_rect, GOvalScaleModeFitCircle,
-                                                DEG_TO_TRIGANGLE(clock_state.minute_angle+55),
-                                                GSize(w*.19, h*.19));
+    GRect day_frame = polar_lookup_centered_rect(PolarRingSubdialCenter, day_center_rect,
+                                                 clock_state.minute_angle+55,
+                                                 GSize(w*.19, h*.19));
     // day dial markers
     int day;
     for (day = 0; day < 7; day = day+1 ) {
@@ -215,8 +216,7 @@ static void draw_day(Layer *layer, GContext *ctx) {
     // day hand
     // end point
     GRect day_to_rect = grect_crop(day_frame, w*.03);
-    GPoint day_to = gpoint_from_polar(day_to_rect, GOvalScaleModeFitCircle,
-                                      DEG_TO_TRIGANGLE(clock_state.day_angle));
+    GPoint day_to = polar_lookup_point(PolarRingDayHandTo, day_to_rect, clock_state.day_angle);
     // draw day hand
     graphics_context_set_stroke_width(ctx, 3);
     graphics_context_set_stroke_color(ctx, enamel_get_clock_fg_color());
@@ -260,16 +260,14 @@ static void draw_marks(Layer *layer, GContext *ctx) {
                                                                     layer_bounds,
                                                                     GTextOverflowModeFill,
                                                                     GTextAlignmentCenter);
-	    GRect text_box = grect_centered_from_polar(text_frame, GOvalScaleModeFitCircle,
-                                                       DEG_TO_TRIGANGLE(angle_from), text_size);
+	    GRect text_box = polar_lookup_centered_rect(PolarRingMinuteLabels, text_frame,
+                                                        angle_from, text_size);
             graphics_draw_text(ctx, s_min_string, digital_font, text_box,
                                GTextOverflowModeFill, GTextAlignmentCenter, NULL);
 	}
         // minute marks
-	GPoint mark_from = gpoint_from_polar(inner_frame, GOvalScaleModeFitCircle,
-			                     DEG_TO_TRIGANGLE(angle_from));
-	GPoint mark_to = gpoint_from_polar(circle_frame, GOvalScaleModeFitCircle,
-		                          DEG_TO_TRIGANGLE(angle_from));
+	GPoint mark_from = polar_lookup_point(PolarRingMinuteMarksFrom, inner_frame, angle_from);
+	GPoint mark_to = polar_lookup_point(PolarRingMinuteMarksTo, circle_frame, angle_from);
 	graphics_draw_line(ctx, mark_from, mark_to);
     }
 }
@@ -284,13 +282,13 @@ static void draw_clock(Layer *layer, GContext *ctx) {
     // start point
     GRect rect_min_from = (GRect) { .size = GSize(w*.22, h*.22) };
     grect_align(&rect_min_from, &layer_bounds, GAlignCenter, false);
-    GPoint min_from = gpoint_from_polar(rect_min_from, GOvalScaleModeFitCircle,
-                                        DEG_TO_TRIGANGLE(clock_state.minute_angle));
+    GPoint min_from = polar_lookup_point(PolarRingMinuteHandFrom, rect_min_from,
+                                         clock_state.minute_angle);
     // end point
     GRect rect_min_to = (GRect) { .size = GSize(w*.82, h*.82) };
     grect_align(&rect_min_to, &layer_bounds, GAlignCenter, false);
-    GPoint min_to = gpoint_from_polar(rect_min_to, GOvalScaleModeFitCircle,
-                                      DEG_TO_TRIGANGLE(clock_state.minute_angle));
+    GPoint min_to = polar_lookup_point(PolarRingMinuteHandTo, rect_min_to,
+                                       clock_state.minute_angle);
     // draw minute hand
     graphics_context_set_stroke_width(ctx, hand_thickness);
     graphics_context_set_stroke_color(ctx, enamel_get_minute_hand_color());
@@ -299,9 +297,9 @@ static void draw_clock(Layer *layer, GContext *ctx) {
     GRect rect_hour_center = (GRect) { .size = GSize(w*.27, h*.27) };
     grect_align(&rect_hour_center, &layer_bounds, GAlignCenter, false);
     // hour dial
-    GRect hour_rect = grect_centered_from_polar(rect_hour_center, GOvalScaleModeFitCircle,
-                                                DEG_TO_TRIGANGLE(clock_state.minute_angle + 180),
-						GSize(w*.34, h*.34));
+    GRect hour_rect = polar_lookup_centered_rect(PolarRingHourDialCenter, rect_hour_center,
+                                                 clock_state.minute_angle + 180,
+                                                 GSize(w*.34, h*.34));
     int text_position = hour_rect.origin.y;
     hour_rect.origin.y = text_position - 1;
     int hour;
@@ -314,24 +312,20 @@ static void draw_clock(Layer *layer, GContext *ctx) {
                                                                 layer_bounds,
                                                                 GTextOverflowModeFill,
                                                                 GTextAlignmentCenter);
-        GRect hour_box = grect_centered_from_polar(hour_rect, GOvalScaleModeFitCircle,
-                                                   DEG_TO_TRIGANGLE(hour_angle), hour_size);
+        GRect hour_box = polar_lookup_centered_rect(PolarRingHourDial, hour_rect,
+                                                    hour_angle, hour_size);
         graphics_draw_text(ctx, s_hour_string, digital_font, hour_box,
                            GTextOverflowModeFill, GTextAlignmentCenter, NULL);
     }
     // hour hand
     // start point
-    GRect hour_from_rect = grect_centered_from_polar(rect_hour_center, GOvalScaleModeFitCircle,
-                                                     DEG_TO_TRIGANGLE(clock_state.minute_angle+180),
-                                                     GSize(w*.05, h*.05));
-    GPoint hour_from = gpoint_from_polar(rect_hour_center, GOvalScaleModeFitCircle,
-                                         DEG_TO_TRIGANGLE(clock_state.minute_angle+180));
+    GPoint hour_from = polar_lookup_point(PolarRingHourDialCenter, rect_hour_center,
+                                          clock_state.minute_angle+180);
     // end point
-    GRect hour_to_rect = grect_centered_from_polar(rect_hour_center, GOvalScaleModeFitCircle,
-                                                   DEG_TO_TRIGANGLE(clock_state.minute_angle+180),
-						   GSize(w*.24, h*.24));
-    GPoint hour_to = gpoint_from_polar(hour_to_rect, GOvalScaleModeFitCircle,
-                                       DEG_TO_TRIGANGLE(clock_state.hour_angle));
+    GRect hour_to_rect = polar_lookup_centered_rect(PolarRingHourDialCenter, rect_hour_center,
+                                                    clock_state.minute_angle+180,
+                                                    GSize(w*.24, h*.24));
+    GPoint hour_to = polar_lookup_point(PolarRingHourHandTo, hour_to_rect, clock_state.hour_angle);
     // draw hour hand
     graphics_context_set_stroke_width(ctx, hand_thickness);
     graphics_context_set_stroke_color(ctx, enamel_get_hour_hand_color());
@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2022 Gonzalo Munoz.
+
+    This file is part of The Essence.
+
+    The Essence is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Essence.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "polar_lookup.h"
+
+// polar math is done in 1/8 px, like the firmware's GPointPrecise
+#define POLAR_PRECISION_SHIFT 3
+#define POLAR_PRECISION_ONE (1 << POLAR_PRECISION_SHIFT)
+#define POLAR_PRECISION_HALF (POLAR_PRECISION_ONE / 2)
+
+static int32_t prv_normalize_degrees(int32_t angle) {
+  angle %= 360;
+  return (angle < 0) ? angle + 360 : angle;
+}
+
+static int32_t prv_sin_offset(PolarRing ring, int32_t degrees) {
+  const int16_t *offsets = polar_ring_offsets[ring];
+  if (degrees <= 90) return offsets[degrees];
+  if (degrees <= 180) return offsets[180 - degrees];
+  if (degrees <= 270) return -offsets[degrees - 180];
+  return -offsets[360 - degrees];
+}
+
+static bool prv_ring_matches(PolarRing ring, const GRect *rect) {
+  return MIN(rect->size.w, rect->size.h) == polar_ring_diameter[ring];
+}
+
+static void prv_point_precise(PolarRing ring, const GRect *rect, int32_t angle,
+                              int32_t *x, int32_t *y) {
+  int32_t degrees = prv_normalize_degrees(angle);
+  *x = rect->origin.x * POLAR_PRECISION_ONE + (rect->size.w - 1) * POLAR_PRECISION_HALF
+       + prv_sin_offset(ring, degrees);
+  *y = rect->origin.y * POLAR_PRECISION_ONE + (rect->size.h - 1) * POLAR_PRECISION_HALF
+       - prv_sin_offset(ring, prv_normalize_degrees(degrees + 90));
+}
+
+GPoint polar_lookup_point(PolarRing ring, GRect rect, int32_t angle) {
+  if (!prv_ring_matches(ring, &rect)) {
+    return gpoint_from_polar(rect, GOvalScaleModeFitCircle, DEG_TO_TRIGANGLE(angle));
+  }
+  int32_t x, y;
+  prv_point_precise(ring, &rect, angle, &x, &y);
+  return GPoint(x >> POLAR_PRECISION_SHIFT, y >> POLAR_PRECISION_SHIFT);
+}
+
+GRect polar_lookup_centered_rect(PolarRing ring, GRect rect, int32_t angle, GSize size) {
+  if (!prv_ring_matches(ring, &rect)) {
+    return grect_centered_from_polar(rect, GOvalScaleModeFitCircle, DEG_TO_TRIGANGLE(angle), size);
+  }
+  int32_t x, y;
+  prv_point_precise(ring, &rect, angle, &x, &y);
+  x -= (size.w - 1) * POLAR_PRECISION_HALF;
+  y -= (size.h - 1) * POLAR_PRECISION_HALF;
+  return (GRect) {
+    .origin = GPoint(x >> POLAR_PRECISION_SHIFT, y >> POLAR_PRECISION_SHIFT),
+    .size = size
+  };
+}
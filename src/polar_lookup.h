@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2022 Gonzalo Munoz.
+
+    This file is part of The Essence.
+
+    The Essence is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Essence.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <pebble.h>
+#include "polar_tables.h"
+
+// Polar lookups on whole-degree angles, backed by the build-time tables in
+// polar_tables.c. Results match gpoint_from_polar()/grect_centered_from_polar()
+// with GOvalScaleModeFitCircle to within a pixel; rects whose circle differs from
+// the full-screen geometry of the ring (e.g. obstructed bounds) fall back to them.
+GPoint polar_lookup_point(PolarRing ring, GRect rect, int32_t angle);
+GRect polar_lookup_centered_rect(PolarRing ring, GRect rect, int32_t angle, GSize size);